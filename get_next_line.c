@@ -6,110 +6,133 @@
 /*   By: earriaga <earriaga@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/02/20 18:48:20 by earriaga          #+#    #+#             */
-/*   Updated: 2023/08/02 14:35:33 by earriaga         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:24:52 by earriaga         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include "./get_next_line.h"
 
 /**
- * @param strr
- * Returns the next string
- * The string starts in the next place from the '\n'
- * @return the resulting string
+ * @param buf
+ * Frees the content saved for the File Descriptor
+ * @returns NULL, so it can be returned directly
  */
-static char	*ft_next_line(char *str)
+static char	*ft_clear(t_buf *buf)
 {
-	int		i;
-	int		j;
-	char	*right_line;
+	free(buf->str);
+	buf->str = NULL;
+	buf->start = 0;
+	buf->len = 0;
+	buf->cap = 0;
+	return (NULL);
+}
 
-	right_line = NULL;
-	if (!str)
-		return (NULL);
-	i = 0;
-	while (str[i] && str[i] != '\n')
-		i++;
-	right_line = (char *)malloc(ft_strlen(str) - i + 1);
-	if (!right_line)
-		return (NULL);
-	j = 0;
-	while (str[i++])
-		right_line[j++] = str[i];
-	right_line[j] = '\0';
-	free(str);
-	return (right_line);
+/**
+ * @param buf
+ * Makes room for BUFFER_SIZE more chars at the end of buf.
+ * The content not returned yet is moved to the front when
+ * that frees enough room, otherwise the buffer doubles its
+ * size, so a long line is not copied again on every read.
+ * A line cut by the end of the buffer is still moved here
+ * @returns 1 or 0 in case of error
+ */
+static int	ft_grow(t_buf *buf)
+{
+	char	*str;
+	size_t	rest;
+	size_t	cap;
+
+	if (buf->len + BUFFER_SIZE <= buf->cap)
+		return (1);
+	rest = buf->len - buf->start;
+	str = buf->str;
+	if (rest + BUFFER_SIZE > buf->cap)
+	{
+		cap = buf->cap * 2 + BUFFER_SIZE;
+		str = (char *)malloc(cap);
+		if (!str)
+			return (0);
+		buf->cap = cap;
+	}
+	if (rest)
+		ft_memmove(str, buf->str + buf->start, rest);
+	if (str != buf->str)
+		free(buf->str);
+	buf->str = str;
+	buf->start = 0;
+	buf->len = rest;
+	return (1);
 }
 
 /** 
- * @param str
- * Reads the content until a '\n' is found or the end 
- * of the string in case no new line is found.
+ * @param buf
+ * @param len
+ * Copies the next len chars of buf, the line length
+ * found by ft_read_line, and moves buf->start past them.
+ * Once everything is returned the buffer is reused from
+ * the start. If a long line made it grow past SHRINK_SIZE,
+ * it goes back to BUFFER_SIZE.
  * @returns the new line including '\n' and '\0'
  */
-static char	*ft_save_line(char *str)
+static char	*ft_save_line(t_buf *buf, size_t len)
 {
 	char	*new_line;
-	int		i;
-	int		j;
+	char	*str;
 
-	i = 0;
-	new_line = NULL;
-	if (!str || !str[i])
-		return (NULL);
-	while (str[i] != '\n' && str[i])
-		i ++;
-	if (str[i] == '\n')
-		new_line = (char *)malloc((i + 2));
-	else
-		new_line = (char *)malloc((i + 1));
+	new_line = (char *)malloc(len + 1);
 	if (!new_line)
 		return (NULL);
-	i = 0;
-	j = 0;
-	while (str[i] && str[i] != '\n')
-		new_line[j++] = str[i++];
-	if (str[i] == '\n')
-		new_line[j++] = str[i++];
-	new_line[i] = '\0';
+	ft_memmove(new_line, buf->str + buf->start, len);
+	new_line[len] = '\0';
+	buf->start += len;
+	if (buf->start != buf->len)
+		return (new_line);
+	buf->start = 0;
+	buf->len = 0;
+	if (buf->cap <= SHRINK_SIZE || buf->cap <= (size_t)BUFFER_SIZE * 4)
+		return (new_line);
+	str = (char *)malloc(BUFFER_SIZE);
+	if (str)
+	{
+		free(buf->str);
+		buf->str = str;
+		buf->cap = BUFFER_SIZE;
+	}
 	return (new_line);
 }
 
 /**
  * @param fd
- * @param str
+ * @param buf
  * Reads from the File Descriptor a size of
  * BUFFER_SIZE until a '\n' is found.
- * Saves the content as its being read
- * @returns the read content or NULL in case of error
+ * Reads straight into the end of buf, looking for the
+ * '\n' only in the chunk that was just read.
+ * '\0' is kept as part of the line like any other char
+ * @returns the length of the next line, 0 if EOF comes
+ * before any '\n' or -1 in case of error
  */
-static char	*ft_read_line(int fd, char *str)
+static ssize_t	ft_read_line(int fd, t_buf *buf)
 {
-	char	*buff;
 	ssize_t	byread;
+	size_t	line;
 
-	buff = (char *)malloc(BUFFER_SIZE + 1);
-	if (!buff)
-		return (NULL);
-	byread = 1;
-	while (!ft_strchr(str, '\n') && byread != 0)
+	line = 0;
+	if (buf->str)
+		line = ft_linelen(buf->str + buf->start, buf->len - buf->start);
+	while (!line)
 	{
-		byread = read(fd, buff, BUFFER_SIZE);
-		if (byread < 0)
-		{
-			free(buff);
-			return (NULL);
-		}
-		buff[byread] = '\0';
-		str = ft_strjoin(str, buff);
-		if (!str)
-		{
-			free(buff);
-			return (NULL);
-		}
+		if (!ft_grow(buf))
+			return (-1);
+		byread = read(fd, buf->str + buf->len, BUFFER_SIZE);
+		if (byread <= 0)
+			return (byread);
+		line = ft_linelen(buf->str + buf->len, byread);
+		if (line)
+			line += buf->len - buf->start;
+		buf->len += byread;
 	}
-	free(buff);
-	return (str);
+	return (line);
 }
 
 /**
@@ -119,27 +142,19 @@ static char	*ft_read_line(int fd, char *str)
  */
 char	*get_next_line(int fd)
 {
-	static char	*container;
-	char		*buffer;
+	static t_buf	buf;
+	char			*line;
+	ssize_t			len;
 
 	if (fd < 0 || BUFFER_SIZE <= 0 || read(fd, 0, 0) < 0)
-	{
-		free(container);
-		container = NULL;
-		return (NULL);
-	}
-	container = ft_read_line(fd, container);
-	if (!container)
-		return (NULL);
-	buffer = ft_save_line(container);
-	if (!buffer)
-	{
-		free(container);
-		container = NULL;
-		return (NULL);
-	}
-	container = ft_next_line(container);
-	if (!container)
-		return (NULL);
-	return (buffer);
+		return (ft_clear(&buf));
+	len = ft_read_line(fd, &buf);
+	if (len == 0)
+		len = buf.len - buf.start;
+	if (len <= 0)
+		return (ft_clear(&buf));
+	line = ft_save_line(&buf, len);
+	if (!line)
+		return (ft_clear(&buf));
+	return (line);
 }
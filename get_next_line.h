@@ -6,7 +6,7 @@
 /*   By: earriaga <earriaga@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/02/20 18:48:28 by earriaga          #+#    #+#             */
-/*   Updated: 2023/08/02 13:42:12 by earriaga         ###   ########.fr       */
+/*   Updated: 2026/10/20 10:31:09 by earriaga         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
@@ -20,10 +20,21 @@
 #  define BUFFER_SIZE 42
 # endif
 
+# ifndef SHRINK_SIZE
+#  define SHRINK_SIZE 65536
+# endif
+
+typedef struct s_buf
+{
+	char	*str;
+	size_t	start;
+	size_t	len;
+	size_t	cap;
+}	t_buf;
+
 char	*get_next_line(int fd);
 
-size_t	ft_strlen(const char *str);
-int		ft_strchr(const char *s, int c);
-char	*ft_strjoin(const char *s1, const char *s2);
+void	*ft_memmove(void *dst, const void *src, size_t n);
+size_t	ft_linelen(const char *str, size_t n);
 
 #endif
\ No newline at end of file
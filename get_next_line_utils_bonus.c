@@ -6,60 +6,35 @@
 /*   By: earriaga <earriaga@student.42madrid.com    +#+  +:+       +#+        */
 /*                                                +#+#+#+#+#+   +#+           */
 /*   Created: 2023/02/22 11:54:13 by earriaga          #+#    #+#             */
-/*   Updated: 2023/08/02 14:34:45 by earriaga         ###   ########.fr       */
+/*   Updated: 2026/10/19 16:54:02 by earriaga         ###   ########.fr       */
 /*                                                                            */
 /* ************************************************************************** */
 
 #include <stdlib.h>
 
-size_t	ft_strlen(const char *str)
+void	*ft_memmove(void *dst, const void *src, size_t n)
 {
-	size_t	x;
+	unsigned char		*d;
+	const unsigned char	*s;
 
-	x = 0;
-	while (str[x] != '\0')
-		x++;
-	return (x);
+	d = (unsigned char *)dst;
+	s = (const unsigned char *)src;
+	if (d > s)
+		while (n--)
+			d[n] = s[n];
+	else
+		while (n--)
+			*d++ = *s++;
+	return (dst);
 }
 
-int	ft_strchr(const char *s, int c)
+size_t	ft_linelen(const char *str, size_t n)
 {
-	int	i;
+	size_t	x;
 
-	i = 0;
-	if (!s)
-		return (0);
-	if (c == '\0')
-		return (1);
-	while (s[i] != '\0')
-		if (s[i++] == (char) c)
-			return (1);
+	x = 0;
+	while (x < n)
+		if (str[x++] == '\n')
+			return (x);
 	return (0);
 }
-
-char	*ft_strjoin(char *first_str, char *second_str)
-{
-	size_t	i;
-	size_t	j;
-	char	*str;
-
-	if (!first_str)
-	{
-		first_str = (char *)malloc(1);
-		first_str[0] = '\0';
-	}
-	if (!first_str || !second_str)
-		return (NULL);
-	str = (char *)malloc(((ft_strlen(first_str) + ft_strlen(second_str)) + 1));
-	if (!str)
-		return (NULL);
-	i = -1;
-	j = 0;
-	while (first_str[++i])
-		str[i] = first_str[i];
-	while (second_str[j])
-		str[i++] = second_str[j++];
-	str[i] = '\0';
-	free(first_str);
-	return (str);
-}